@@ -1,4 +1,6 @@
 #include <iostream>
+#include <cassert>
+#include <stdexcept>
 using namespace std;
 
 template <class T>
@@ -6,6 +8,9 @@ class Node {  // Node [data | pointer to next node]
     T data;
     Node* next;  // Pointer should have same type as what it points to
 
+    template <class U> friend class LinkedList;          // Needs to relink nodes
+    template <class U> friend class LinkedListIterator;  // Needs to read data and follow next
+
 public:
     Node() : next(nullptr) {};
     Node(T data) : data(data), next(nullptr) {};
@@ -99,9 +104,7 @@ class LinkedList {
     Node<T>* tail; // Points to last node
 
 public:
-    LinkedList(){
-        destroyList(); //Destroy all previous nodes and reset all data items
-    }
+    LinkedList() : size(0), head(nullptr), tail(nullptr) {}  // Nothing to destroy yet: start empty
 
     //  Destroys all nodes in the list
     void destroyList() {
@@ -207,7 +210,7 @@ public:
     * @param other The list to copy from
     * Uses copyList() to avoid code duplication
     */
-    LinkedList(const LinkedList<T>& other) : head(nullptr), tail(nullptr), size(0) {
+    LinkedList(const LinkedList<T>& other) : size(0), head(nullptr), tail(nullptr) {
         copyList(other);
     }
     LinkedList& operator=(const LinkedList& other) {
@@ -0,0 +1,232 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LinkedList.cpp"
+#include "PersistentLinkedList.cpp"
+using namespace std;
+
+/*
+Compares the deep-copy LinkedList with the structurally shared PersistentLinkedList.
+Build: g++ -std=c++17 -O2 -pthread LinkedListBenchmark.cpp -o LinkedListBenchmark
+The reader/writer scenario doubles as a thread-safety check when built with
+-fsanitize=thread.
+
+Every allocation in the program goes through the global operator new below,
+so the counters show how many nodes (and bytes) each scenario creates and how
+many are still alive at the end of it.
+*/
+// Atomic because the reader/writer scenario allocates from several threads
+static atomic<long long> allocations{0};  // Total calls to operator new
+static atomic<long long> allocatedBytes{0};
+static atomic<long long> liveAllocations{0};  // new minus delete
+
+void* operator new(size_t bytes) {
+    allocations.fetch_add(1, memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, memory_order_relaxed);
+    liveAllocations.fetch_add(1, memory_order_relaxed);
+    if (void* memory = malloc(bytes)) {
+        return memory;
+    }
+    throw bad_alloc();
+}
+// GCC flags free() here once it inlines this replacement into std code; the pairing is correct
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* memory) noexcept {
+    if (memory != nullptr) {
+        liveAllocations.fetch_sub(1, memory_order_relaxed);
+        free(memory);
+    }
+}
+void operator delete(void* memory, size_t) noexcept {
+    operator delete(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Measures one scenario: wall time plus the allocation counters around it
+class Measurement {
+    string name;
+    chrono::steady_clock::time_point start;
+    long long startAllocations, startBytes, startLive;
+
+public:
+    explicit Measurement(string name)
+        : name(std::move(name)), start(chrono::steady_clock::now()),
+          startAllocations(allocations), startBytes(allocatedBytes), startLive(liveAllocations) {}
+
+    // Call while the data of the scenario is still alive so 'live' shows what it holds
+    void report() const {
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << name << ": " << ms << " ms, "
+             << allocations - startAllocations << " allocations, "
+             << allocatedBytes - startBytes << " bytes, "
+             << liveAllocations - startLive << " still live" << endl;
+    }
+};
+
+const int listSize = 10000;  // Elements in the list being snapshotted
+const int updates = 1000;    // Updates, each followed by a snapshot for readers
+const int deletes = 1000;    // Middle deletes
+const int readers = 4;       // Reader threads in the reader/writer scenario
+const chrono::milliseconds readersDuration(500);  // How long the reader/writer scenario runs
+
+// Builds a list of listSize elements with push-front
+template <class List>
+void benchBuild(const string& name) {
+    Measurement m(name + " buildListBackward x" + to_string(listSize));
+    List list;
+    for (int i = 0; i < listSize; i++) {
+        list.buildListBackward(i);
+    }
+    m.report();
+}
+
+// "Snapshot on every update": push-front, then copy the list for the readers and keep the copy
+template <class List>
+void benchSnapshots(const string& name) {
+    List list;
+    for (int i = 0; i < listSize; i++) {
+        list.buildListBackward(i);
+    }
+    // Reserved before timing: the first big allocation after the previous scenario's
+    // frees can make malloc tidy up its free lists, which is not what we measure
+    vector<List> snapshots;
+    snapshots.reserve(updates);
+    Measurement m(name + " buildListBackward + snapshot x" + to_string(updates));
+    for (int i = 0; i < updates; i++) {
+        list.buildListBackward(listSize + i);
+        snapshots.push_back(list);
+    }
+    m.report();
+}
+
+// Deletes from the middle of the list, taking a snapshot before each delete
+template <class List>
+void benchDeletes(const string& name) {
+    List list;
+    for (int i = 0; i < listSize; i++) {
+        list.buildListBackward(i);
+    }
+    vector<List> snapshots;
+    snapshots.reserve(deletes);  // Before timing, as in benchSnapshots
+    streambuf* saved = cout.rdbuf(nullptr);  // deleteNode prints a line per call
+    Measurement m(name + " snapshot + deleteNode(middle) x" + to_string(deletes));
+    for (int i = 0; i < deletes; i++) {
+        snapshots.push_back(list);
+        list.deleteNode(listSize / 2 + i);
+    }
+    cout.rdbuf(saved);
+    m.report();
+}
+
+/*
+Readers on other threads: for a fixed time one writer keeps updating the list
+and hands each new version to the readers, while 'readers' threads keep taking
+the latest version and iterating it. The writer also appends (path copying)
+and now and then starts over, so old versions are freed while readers may
+still hold them. Reports how many updates and reader snapshots got through.
+*/
+template <class Sharing>
+void benchReaders(const string& name) {
+    Sharing sharing;
+    atomic<bool> done{false};
+    atomic<long long> snapshotsRead{0};
+    atomic<long long> elementsRead{0};
+    long long writerUpdates = 0;
+    {
+        Measurement m(name + " " + to_string(readers) + " readers + 1 writer for " +
+                      to_string(readersDuration.count()) + " ms");
+        typename Sharing::List list;
+        for (int i = 0; i < listSize; i++) {
+            list.buildListBackward(i);
+        }
+        sharing.publish(list);
+
+        vector<thread> threads;
+        for (int r = 0; r < readers; r++) {
+            threads.emplace_back([&]() {
+                while (!done.load()) {
+                    long long count = 0;
+                    for (int value : sharing.acquire()) {
+                        count += (value != -2);  // Touch every element so the loop is not optimized away
+                    }
+                    snapshotsRead.fetch_add(1, memory_order_relaxed);
+                    elementsRead.fetch_add(count, memory_order_relaxed);
+                }
+            });
+        }
+        auto stopAt = chrono::steady_clock::now() + readersDuration;
+        while (chrono::steady_clock::now() < stopAt) {
+            list.buildListBackward(listSize + (int)writerUpdates);
+            if (writerUpdates % 100 == 0) {
+                list.buildListForward(-1);
+            }
+            if (writerUpdates % 500 == 499) {  // Start over: old versions are freed by whoever drops them last
+                list.destroyList();
+                for (int i = 0; i < listSize; i++) {
+                    list.buildListBackward(i);
+                }
+            }
+            sharing.publish(list);
+            writerUpdates++;
+        }
+        done.store(true);
+        for (thread& t : threads) {
+            t.join();
+        }
+        m.report();
+    }
+    cout << "    writer updates: " << writerUpdates
+         << ", snapshots iterated by readers: " << snapshotsRead.load()
+         << " (" << elementsRead.load() << " elements)" << endl;
+}
+
+// Readers take an O(1) copy of the latest published version
+struct PersistentSharing {
+    using List = PersistentLinkedList<int>;
+    PersistentListPublisher<int> publisher;
+
+    void publish(const List& list) {
+        publisher.publish(list);
+    }
+    List acquire() const {
+        return publisher.acquire();
+    }
+};
+
+// Current deep-copy path: readers copy the whole list while holding the mutex
+struct DeepCopySharing {
+    using List = LinkedList<int>;
+    mutable mutex lock;
+    List latest;
+
+    void publish(const List& list) {
+        lock_guard<mutex> guard(lock);
+        latest = list;
+    }
+    List acquire() const {
+        lock_guard<mutex> guard(lock);
+        return latest;
+    }
+};
+
+int main() {
+    benchBuild<LinkedList<int>>("LinkedList          ");
+    benchBuild<PersistentLinkedList<int>>("PersistentLinkedList");
+    benchSnapshots<LinkedList<int>>("LinkedList          ");
+    benchSnapshots<PersistentLinkedList<int>>("PersistentLinkedList");
+    benchDeletes<LinkedList<int>>("LinkedList          ");
+    benchDeletes<PersistentLinkedList<int>>("PersistentLinkedList");
+    benchReaders<DeepCopySharing>("LinkedList          ");
+    benchReaders<PersistentSharing>("PersistentLinkedList");
+    return 0;
+}
@@ -0,0 +1,375 @@
+#include <iostream>
+#include <mutex>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+using namespace std;
+
+/*
+Persistent (immutable) singly linked list.
+Every modification produces a new version of the list; old versions stay valid
+and unchanged. Versions share as many nodes as possible (structural sharing):
+
+    v1 = [B] -> [C]
+    v2 = v1 + buildListBackward(A)
+
+    v2.head -> [A]
+                 \
+    v1.head ----> [B] -> [C] -> nullptr    (B and C belong to both versions)
+
+Every node carries an atomic reference count: one reference per list version
+whose head is the node, plus one from the node in front of it. A node is freed
+by the thread whose decrement takes the count from 1 to 0, so a reader holding
+its own copy (a snapshot) can iterate it safely while the writer keeps
+producing new versions. One PersistentLinkedList object must not be written and
+read by two threads at the same time, so versions are handed to readers through
+PersistentListPublisher (see the bottom of the file): the writer publish()es
+each new version and every reader acquire()s its own O(1) copy.
+
+Complexities:
+    copy / operator=     O(1)  (just shares the head)
+    buildListBackward    O(1)  (new node points at old head)
+    buildListForward     O(n)  (path copying: every node before the new one is copied)
+    deleteNode           O(k)  (copies the k nodes before the deleted one, shares the rest)
+*/
+template <class T>
+class PersistentNode {  // PersistentNode [data | pointer to next node | reference count]
+public:
+    const T data;                        // Never changes after construction (node may be shared)
+    const PersistentNode<T>* next;       // Owns one reference to the next node
+    mutable atomic<int> refCount;        // Changed even through const pointers (sharing is not a write)
+
+    // A new node starts with the one reference held by whoever created it
+    PersistentNode(const T& data) : data(data), next(nullptr), refCount(1) {}
+
+    // Adds a reference to node (nullptr is allowed)
+    static void retain(const PersistentNode<T>* node) {
+        if (node != nullptr) {
+            node->refCount.fetch_add(1, memory_order_relaxed);  // Caller already holds a reference
+        }
+    }
+
+    /**
+     * @brief Drops one reference to node and frees every node that became unused
+     * @param node Reference to drop (nullptr is allowed)
+     * fetch_sub returns the old count, so exactly one thread sees 1 and frees
+     * the node; acq_rel makes every earlier access by the other owners finish
+     * before the delete. The freed node's own reference to 'next' is dropped in
+     * the same loop, so a long chain is freed without recursion.
+     */
+    static void release(const PersistentNode<T>* node) {
+        while (node != nullptr && node->refCount.fetch_sub(1, memory_order_acq_rel) == 1) {
+            const PersistentNode<T>* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+};
+
+// Owns one reference to a node, like a shared_ptr whose count lives in the node
+template <class T>
+class PersistentNodeRef {
+    const PersistentNode<T>* node;
+
+public:
+    PersistentNodeRef() : node(nullptr) {}
+
+    // Takes over a reference the caller already holds (e.g. a node fresh from new)
+    explicit PersistentNodeRef(const PersistentNode<T>* node) : node(node) {}
+
+    // Adds a new reference to a node owned by someone else
+    static PersistentNodeRef share(const PersistentNode<T>* node) {
+        PersistentNode<T>::retain(node);
+        return PersistentNodeRef(node);
+    }
+
+    PersistentNodeRef(const PersistentNodeRef& other) : node(other.node) {
+        PersistentNode<T>::retain(node);
+    }
+    PersistentNodeRef(PersistentNodeRef&& other) noexcept : node(other.node) {
+        other.node = nullptr;
+    }
+    PersistentNodeRef& operator=(const PersistentNodeRef& other) {
+        PersistentNode<T>::retain(other.node);  // Retain first, so self-assignment is safe
+        PersistentNode<T>::release(node);
+        node = other.node;
+        return *this;
+    }
+    PersistentNodeRef& operator=(PersistentNodeRef&& other) noexcept {
+        if (this != &other) {
+            PersistentNode<T>::release(node);
+            node = other.node;
+            other.node = nullptr;
+        }
+        return *this;
+    }
+    ~PersistentNodeRef() {
+        PersistentNode<T>::release(node);
+    }
+
+    const PersistentNode<T>* get() const {
+        return node;
+    }
+
+    // Gives the reference away without dropping it (e.g. to a node's 'next')
+    const PersistentNode<T>* detach() {
+        const PersistentNode<T>* detached = node;
+        node = nullptr;
+        return detached;
+    }
+};
+
+template <class Type>
+class PersistentLinkedListIterator {
+    const PersistentNode<Type>* current; // Raw pointer is enough: the list being iterated keeps the nodes alive
+
+public:
+    // Type aliases (STL convention)
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+    using iterator_category = std::forward_iterator_tag;
+
+    PersistentLinkedListIterator() : current(nullptr) {}
+
+    /**
+     * @brief Construct from node pointer
+     * @param node Pointer to node to start iteration from
+     */
+    explicit PersistentLinkedListIterator(const PersistentNode<Type>* node) : current(node) {}
+
+    /**
+     * @brief Dereference operator - read-only access to current node's data
+     * @return Const reference to current node's data (nodes are shared, so no writes)
+     * @throws std::out_of_range if iterator is invalid
+     */
+    const Type& operator*() const {
+        if (!current) {
+            throw std::out_of_range("Dereferencing null iterator");
+        }
+        return current->data;
+    }
+
+    const Type* operator->() const {
+        return &(operator*());
+    }
+
+    PersistentLinkedListIterator& operator++() {
+        if (current) {
+            current = current->next;
+        }
+        return *this;
+    }
+
+    PersistentLinkedListIterator operator++(int) {
+        PersistentLinkedListIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    bool operator==(const PersistentLinkedListIterator& other) const {
+        return current == other.current;
+    }
+
+    bool operator!=(const PersistentLinkedListIterator& other) const {
+        return !(*this == other);
+    }
+};
+
+template <class T>
+class PersistentLinkedList {
+    int size{};                         // Number of elements in this version
+    PersistentNodeRef<T> head;          // Starting point (shared with other versions)
+    const PersistentNode<T>* tail{};    // Last node, kept alive by head
+
+public:
+    PersistentLinkedList() : size(0), head(), tail(nullptr) {}
+
+    /**
+     * @brief Copy constructor / assignment - O(1), the list shares every node with other
+     * @param other The list to copy from
+     */
+    PersistentLinkedList(const PersistentLinkedList<T>& other) = default;
+    PersistentLinkedList& operator=(const PersistentLinkedList& other) = default;
+    PersistentLinkedList(PersistentLinkedList<T>&& other) noexcept
+        : size(other.size), head(std::move(other.head)), tail(other.tail) {
+        other.size = 0;
+        other.tail = nullptr;
+    }
+    PersistentLinkedList& operator=(PersistentLinkedList&& other) noexcept {
+        if (this != &other) {
+            head = std::move(other.head);
+            tail = other.tail;
+            size = other.size;
+            other.tail = nullptr;
+            other.size = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Drops this version's reference to its nodes
+     * Nodes still used by another version are left alone; the ones owned only
+     * by this version are freed (see PersistentNode::release).
+     */
+    void destroyList() {
+        head = PersistentNodeRef<T>();
+        tail = nullptr;
+        size = 0;
+    }
+    bool isEmpty() const {
+        return head.get() == nullptr;
+    }
+    void print() const {
+        for (const PersistentNode<T>* current = head.get(); current != nullptr; current = current->next) {
+            cout << current->data << " ";
+        }
+    }
+    int length() const {
+        return size;
+    }
+    T front() const {
+        assert(head.get() != nullptr);
+        return head.get()->data;
+    }
+    T back() const {
+        assert(tail != nullptr);
+        return tail->data;
+    }
+    PersistentLinkedListIterator<T> begin() const {
+        return PersistentLinkedListIterator<T>(head.get());
+    }
+    PersistentLinkedListIterator<T> end() const {
+        return PersistentLinkedListIterator<T>(nullptr);
+    }
+
+    // Makes this list share the contents of another list - O(1), no node is copied
+    void copyList(const PersistentLinkedList<T>& otherList) {
+        *this = otherList;
+    }
+
+    // Insert node at beginning of the list - O(1), the old nodes are shared as the new tail part
+    void buildListBackward(T data) {
+        PersistentNode<T>* newNode = new PersistentNode<T>(data);
+        newNode->next = head.detach();  // The list's reference to the old head moves into the new node
+        head = PersistentNodeRef<T>(newNode);
+        if (tail == nullptr) {  // Empty list check
+            tail = newNode;
+        }
+        size++;
+    }
+
+    /**
+     * @brief Insert node at end of the list - O(n) path copying
+     * The last node of the old version cannot be changed (other versions may
+     * use it), so every node is copied and the copies are linked to the new one.
+     */
+    void buildListForward(T data) {
+        PersistentNode<T>* newNode = new PersistentNode<T>(data);
+        const PersistentNode<T>* lastCopy;
+        head = copyPrefix(head.get(), nullptr, PersistentNodeRef<T>(newNode), lastCopy);
+        tail = newNode;
+        size++;
+    }
+    bool search(const T& searchItem) const {
+        for (const PersistentNode<T>* current = head.get(); current != nullptr; current = current->next) {
+            if (current->data == searchItem) {
+                return true;  // Found match
+            }
+        }
+        return false;  // Reached end without finding
+    }
+
+    /**
+     * @brief Removes the first node holding deleteItem
+     * Only the nodes before the deleted one are copied; everything after it is
+     * shared with the previous version.
+     */
+    bool deleteNode(const T& deleteItem) {
+        // Case 1: Empty list
+        if (isEmpty()) {
+            std::cout << "Cannot delete from empty list." << std::endl;
+            return false;
+        }
+
+        const PersistentNode<T>* current = head.get();
+        while (current != nullptr && !(current->data == deleteItem)) {
+            current = current->next;
+        }
+
+        // Item not found
+        if (current == nullptr) {
+            cout << "Item " << deleteItem << " not found in list." << endl;
+            return false;
+        }
+
+        cout << "Deleted node with value: " << current->data << std::endl;
+        // The old version stays alive until the new head is assigned, so 'current' is valid here
+        const PersistentNode<T>* lastCopy;
+        head = copyPrefix(head.get(), current, PersistentNodeRef<T>::share(current->next), lastCopy);
+        // Deleting last node: the new tail is the copy of the node before it (or nothing)
+        if (current == tail) {
+            tail = lastCopy;
+        }
+        size--;
+        return true;
+    }
+    ~PersistentLinkedList() {
+        destroyList();  // Reuse the cleanup logic
+    }
+
+private:
+    /**
+     * @brief Copies the nodes from 'first' up to (not including) 'stop' and
+     * links the last copy to 'rest'
+     * @param lastCopy Set to the last copied node (nullptr if nothing was copied)
+     * @return Head of the new chain
+     */
+    static PersistentNodeRef<T> copyPrefix(const PersistentNode<T>* first, const PersistentNode<T>* stop,
+                                           PersistentNodeRef<T> rest, const PersistentNode<T>*& lastCopy) {
+        lastCopy = nullptr;
+        if (first == stop) {
+            return rest;
+        }
+        // Build a fresh head node, then append copies one by one (nodes are
+        // only immutable once published, so we fill 'next' before sharing)
+        PersistentNode<T>* newHead = new PersistentNode<T>(first->data);
+        PersistentNodeRef<T> result(newHead);  // Frees the copies made so far if a later new throws
+        PersistentNode<T>* currentThis = newHead;
+        for (const PersistentNode<T>* currentOther = first->next; currentOther != stop; currentOther = currentOther->next) {
+            PersistentNode<T>* newNode = new PersistentNode<T>(currentOther->data);
+            currentThis->next = newNode;  // Takes over newNode's initial reference
+            currentThis = newNode;
+        }
+        currentThis->next = rest.detach();
+        lastCopy = currentThis;
+        return result;
+    }
+};
+
+/*
+Hands list versions from one writer thread to any number of reader threads.
+The writer builds a new version on its own copy and publish()es it; each reader
+acquire()s the latest version and iterates that copy for as long as it likes.
+Only the O(1) copy of the head happens under the lock; an old version that
+becomes unused is released after the lock is dropped.
+*/
+template <class T>
+class PersistentListPublisher {
+    mutable mutex lock;
+    PersistentLinkedList<T> latest;
+
+public:
+    void publish(PersistentLinkedList<T> version) {
+        {
+            lock_guard<mutex> guard(lock);
+            swap(latest, version);
+        }
+        // 'version' now holds the previous one and is released here, outside the lock
+    }
+    PersistentLinkedList<T> acquire() const {
+        lock_guard<mutex> guard(lock);
+        return latest;
+    }
+};